@@ -0,0 +1 @@
+../expressions/fields/fieldExprScanner.cc
\ No newline at end of file
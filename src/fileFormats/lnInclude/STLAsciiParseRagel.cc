@@ -0,0 +1 @@
+../stl/STLAsciiParseRagel.cc
\ No newline at end of file
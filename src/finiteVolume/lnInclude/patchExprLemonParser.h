@@ -0,0 +1 @@
+../expressions/patch/patchExprLemonParser.h
\ No newline at end of file
@@ -0,0 +1 @@
+../expressions/patch/patchExprScanner.cc
\ No newline at end of file
@@ -0,0 +1 @@
+../expressions/volume/volumeExprScanner.cc
\ No newline at end of file